@@ -0,0 +1,86 @@
+/*---------------------------------------------------------------------------*\
+     ██╗████████╗██╗  ██╗ █████╗  ██████╗ █████╗       ███████╗██╗   ██╗
+     ██║╚══██╔══╝██║  ██║██╔══██╗██╔════╝██╔══██╗      ██╔════╝██║   ██║
+     ██║   ██║   ███████║███████║██║     ███████║█████╗█████╗  ██║   ██║
+     ██║   ██║   ██╔══██║██╔══██║██║     ██╔══██║╚════╝██╔══╝  ╚██╗ ██╔╝
+     ██║   ██║   ██║  ██║██║  ██║╚██████╗██║  ██║      ██║      ╚████╔╝
+     ╚═╝   ╚═╝   ╚═╝  ╚═╝╚═╝  ╚═╝ ╚═════╝╚═╝  ╚═╝      ╚═╝       ╚═══╝
+
+ * In real Time Highly Advanced Computational Applications for Finite Volumes
+ * Copyright (C) 2017 by the ITHACA-FV authors
+-------------------------------------------------------------------------------
+
+License
+    This file is part of ITHACA-FV
+
+    ITHACA-FV is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    ITHACA-FV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with ITHACA-FV. If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+
+#ifndef MS_KDTREE_H
+#define MS_KDTREE_H
+
+#include <definitions.h>
+#include <vector>
+
+namespace SPLINTER
+{
+
+/*
+ * Static k-d tree over the rows of a point matrix (numPoints x dim).
+ * The tree is built once with median splits along the direction of largest
+ * spread and is used for the fixed-radius neighbor queries needed by
+ * compactly supported radial basis functions.
+ */
+class KdTree
+{
+public:
+
+    KdTree(const DenseMatrix& points, unsigned int leafSize = 16);
+
+    /*
+     * Returns the indices and the distances of all the points within
+     * the given radius from x
+     */
+    void radiusSearch(const DenseVector& x, double radius,
+                      std::vector<unsigned int>& indices,
+                      std::vector<double>& distances) const;
+
+    unsigned int getNumPoints() const { return points.rows(); }
+
+private:
+
+    struct Node
+    {
+        unsigned int begin, end;
+        int left, right;
+        unsigned int axis;
+        double split;
+    };
+
+    DenseMatrix points;
+    unsigned int leafSize;
+    std::vector<unsigned int> index;
+    std::vector<Node> nodes;
+
+    int build(unsigned int begin, unsigned int end);
+    void search(int node, const DenseVector& x, double radius2,
+                std::vector<unsigned int>& indices,
+                std::vector<double>& distances) const;
+};
+
+} // namespace SPLINTER
+
+#endif // MS_KDTREE_H
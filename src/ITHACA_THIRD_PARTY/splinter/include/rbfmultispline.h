@@ -0,0 +1,175 @@
+/*---------------------------------------------------------------------------*\
+     ██╗████████╗██╗  ██╗ █████╗  ██████╗ █████╗       ███████╗██╗   ██╗
+     ██║╚══██╔══╝██║  ██║██╔══██╗██╔════╝██╔══██╗      ██╔════╝██║   ██║
+     ██║   ██║   ███████║███████║██║     ███████║█████╗█████╗  ██║   ██║
+     ██║   ██║   ██╔══██║██╔══██║██║     ██╔══██║╚════╝██╔══╝  ╚██╗ ██╔╝
+     ██║   ██║   ██║  ██║██║  ██║╚██████╗██║  ██║      ██║      ╚████╔╝
+     ╚═╝   ╚═╝   ╚═╝  ╚═╝╚═╝  ╚═╝ ╚═════╝╚═╝  ╚═╝      ╚═╝       ╚═══╝
+
+ * In real Time Highly Advanced Computational Applications for Finite Volumes
+ * Copyright (C) 2017 by the ITHACA-FV authors
+-------------------------------------------------------------------------------
+
+License
+    This file is part of ITHACA-FV
+
+    ITHACA-FV is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    ITHACA-FV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with ITHACA-FV. If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+
+#ifndef MS_RBFMULTISPLINE_H
+#define MS_RBFMULTISPLINE_H
+
+#include <datatable.h>
+#include <rbfspline.h>
+#include <kdtree.h>
+#include <memory>
+#include <vector>
+
+namespace SPLINTER
+{
+
+/*
+ * Linear solver used for the compactly supported kernels. DIRECT uses a sparse
+ * Cholesky (LDLT) factorization, ITERATIVE uses the conjugate gradient method
+ * preconditioned with an incomplete Cholesky factorization.
+ */
+enum class RBFSolverType
+{
+    DIRECT,
+    ITERATIVE
+};
+
+/*
+ * Multi-output radial basis function spline.
+ * All the outputs are interpolated on the same sample locations, hence the
+ * kernel matrix is assembled and factorized only once for each distinct
+ * shape parameter and the weights of all the outputs are obtained from a
+ * single multi right-hand side solve. The evaluation returns all the outputs
+ * at once, and the evaluation at many points reduces to one
+ * kernel-matrix x weights product.
+ * For compactly supported kernels (WENDLAND) the kernel matrix is assembled
+ * in sparse format from the neighbors found with a k-d tree, it is solved with
+ * a sparse direct or a preconditioned iterative solver, and the evaluation
+ * only visits the samples inside the support.
+ */
+class RBFMultiSpline
+{
+public:
+
+    /*
+     * Construct from the samples x (numSamples x dim) and the values
+     * y (numSamples x numOutputs), using the same shape parameter for all the outputs
+     */
+    RBFMultiSpline(const DenseMatrix& x, const DenseMatrix& y,
+                   RadialBasisFunctionType type, double e = 1.0,
+                   RBFSolverType solver = RBFSolverType::DIRECT, double tolerance = 1e-10);
+
+    /*
+     * Construct from the samples x (numSamples x dim) and the values
+     * y (numSamples x numOutputs), with one shape parameter per output
+     */
+    RBFMultiSpline(const DenseMatrix& x, const DenseMatrix& y,
+                   RadialBasisFunctionType type, const DenseVector& e,
+                   RBFSolverType solver = RBFSolverType::DIRECT, double tolerance = 1e-10);
+
+    /*
+     * Construct from one DataTable per output. The tables must share the same
+     * sample locations, the samples are taken in the (sorted) table order so that
+     * the columns of the weights are compatible with RBFSpline
+     */
+    RBFMultiSpline(const std::vector<DataTable*>& samples,
+                   RadialBasisFunctionType type, const DenseVector& e,
+                   RBFSolverType solver = RBFSolverType::DIRECT, double tolerance = 1e-10);
+
+    /*
+     * Construct from precomputed weights w (numSamples x numOutputs), no solve is performed
+     */
+    RBFMultiSpline(const DenseMatrix& x, RadialBasisFunctionType type,
+                   const DenseMatrix& w, const DenseVector& e);
+
+    /*
+     * Construct from one DataTable per output and the precomputed weights
+     * w (numSamples x numOutputs) in the table order, no solve is performed
+     */
+    RBFMultiSpline(const std::vector<DataTable*>& samples,
+                   RadialBasisFunctionType type, const DenseMatrix& w, const DenseVector& e);
+
+    /*
+     * Returns the value of all the outputs at x
+     */
+    DenseVector eval(const DenseVector& x) const;
+
+    /*
+     * Returns the value of all the outputs (columns) at all the points x (rows)
+     */
+    DenseMatrix evalBatch(const DenseMatrix& x) const;
+
+    /*
+     * Returns the (numPoints x numSamples) kernel matrix between x and the samples
+     * for the shape parameter e
+     */
+    DenseMatrix kernelMatrix(const DenseMatrix& x, double e) const;
+
+    unsigned int getNumVariables() const { return dim; }
+    unsigned int getNumSamples() const { return numSamples; }
+    unsigned int getNumOutputs() const { return numOutputs; }
+    bool isCompact() const { return type == RadialBasisFunctionType::WENDLAND; }
+
+    /*
+     * Weights of the outputs, one column per output
+     */
+    DenseMatrix weights;
+
+private:
+
+    /*
+     * Outputs sharing the same shape parameter, hence the same kernel matrix
+     */
+    struct KernelGroup
+    {
+        std::shared_ptr<RadialBasisFunction> fn;
+        std::vector<unsigned int> outputs;
+        DenseMatrix weights;
+    };
+
+    DenseMatrix samples;
+    RadialBasisFunctionType type;
+    unsigned int dim, numSamples, numOutputs;
+    RBFSolverType solver;
+    double tolerance;
+    std::vector<KernelGroup> groups;
+
+    // Neighbor search structure over the samples, only for compact kernels
+    std::shared_ptr<KdTree> tree;
+
+    static DenseMatrix tableSamples(const std::vector<DataTable*>& tables);
+    std::shared_ptr<RadialBasisFunction> makeFunction(double e) const;
+    void setWeights(const DenseMatrix& w);
+    void setupGroups(const DenseVector& e);
+    void computeWeights(const DenseMatrix& y);
+    void computeSparseWeights(KernelGroup& g, const DenseMatrix& b);
+    void gatherWeights();
+    DenseMatrix kernelMatrix(const DenseMatrix& x,
+                             const RadialBasisFunction& fn) const;
+    SparseMatrix sparseKernelMatrix(const DenseMatrix& x,
+                                    const RadialBasisFunction& fn) const;
+    DenseVector evalGroup(const DenseVector& x, const KernelGroup& g) const;
+    DenseMatrix evalGroupBatch(const DenseMatrix& x, const KernelGroup& g) const;
+};
+
+} // namespace SPLINTER
+
+#endif // MS_RBFMULTISPLINE_H
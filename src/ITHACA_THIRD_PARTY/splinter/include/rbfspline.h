@@ -24,7 +24,8 @@ enum class RadialBasisFunctionType
     INVERSE_QUADRIC,
     INVERSE_MULTIQUADRIC,
     THIN_PLATE_SPLINE,
-    GAUSSIAN
+    GAUSSIAN,
+    WENDLAND
 };
 
 /*
@@ -107,6 +108,33 @@ public:
     }
 };
 
+/*
+ * Compactly supported C2 Wendland function (1 - e*r)_+^(l+1)*((l+1)*e*r + 1)
+ * with support radius 1/e. The exponent l = floor(dim/2) + 2 makes the
+ * function positive definite in R^dim, hence the kernel matrix is sparse
+ * and symmetric positive definite.
+ */
+class Wendland : public RadialBasisFunction
+{
+public:
+    Wendland(unsigned int dim = 3) : l(dim/2 + 2) {}
+    double eval(double r) const
+    {
+        double s = e*r;
+        return (s>=1.0) ? 0.0 : std::pow(1.0 - s, l + 1)*((l + 1)*s + 1.0);
+    }
+    double evalDerivative(double r) const
+    {
+        double s = e*r;
+        return (s>=1.0) ? 0.0 : -e*(l + 1)*(l + 2)*s*std::pow(1.0 - s, l);
+    }
+    double supportRadius() const
+    {
+        return 1.0/e;
+    }
+    unsigned int l;
+};
+
 /*
  * Class for radial basis function splines.
  * The RBF splines support scattered sampling, but their construction require